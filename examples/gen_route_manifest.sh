@@ -0,0 +1,184 @@
+#!/usr/bin/env bash
+# Generates a route manifest header from file-based route sources.
+#
+# Usage: gen_route_manifest.sh <app_dir> <source>...
+#
+# <app_dir> is the workspace-relative app directory (e.g.
+# examples/router_dynamic/app). Each source below it is mapped to a route
+# pattern by the app/ file naming convention:
+#   index.cpp      -> the directory's own path
+#   _layout.cpp    -> layout for the directory's path
+#   [id].cpp       -> dynamic segment ":id"
+#   name.cpp       -> static segment "name"
+# Catch-all ([...rest]) and optional ([[opt]]) names are rejected, since the
+# Router cannot match them.
+#
+# Each source must register exactly one pattern with REGISTER_ROUTE or
+# REGISTER_LAYOUT, and that literal must equal the pattern derived from its
+# file name, since the literal is what the Router actually matches. Two files
+# that map to the same route are rejected, as are sibling dynamic segments
+# with different names (x/[a].cpp next to x/[b].cpp). Entries are emitted
+# sorted by (pattern, kind).
+
+set -euo pipefail
+set -f
+
+app_dir="$1"
+shift
+
+# The REGISTER_* line in each source, matched without forking per file
+register_re='^[[:space:]]*REGISTER_(ROUTE|LAYOUT)[[:space:]]*\([[:space:]]*"([^"]*)"'
+
+entries=""
+params=""
+for src in "$@"; do
+    rel="${src#"$app_dir"/}"
+    if [[ "$rel" == "$src" ]]; then
+        echo "gen_route_manifest: $src is not under $app_dir" >&2
+        exit 1
+    fi
+    if [[ "$rel" == *"[["* || "$rel" == *"[..."* ]]; then
+        echo "gen_route_manifest: $src uses a catch-all or optional segment, which the Router does not support" >&2
+        exit 1
+    fi
+
+    dir=""
+    file="$rel"
+    if [[ "$rel" == */* ]]; then
+        dir="${rel%/*}"
+        file="${rel##*/}"
+    fi
+    stem="${file%.cpp}"
+
+    # Each dynamic segment is recorded under its parent prefix so siblings
+    # can be compared after sorting
+    pattern=""
+    segments=()
+    if [[ -n "$dir" ]]; then
+        IFS='/' read -r -a segments <<< "$dir"
+    fi
+
+    # Kind is encoded as 0/1 so a plain byte sort orders layouts first
+    case "$stem" in
+        _layout) kind=0 ;;
+        index)   kind=1 ;;
+        _*)      continue ;;
+        *)       kind=1; segments+=("$stem") ;;
+    esac
+
+    for segment in ${segments[@]+"${segments[@]}"}; do
+        if [[ "$segment" == \[*\] ]]; then
+            segment="${segment#[}"
+            segment=":${segment%]}"
+            params+="$pattern/"$'\t'"$segment"$'\t'"$rel"$'\n'
+        fi
+        pattern="$pattern/$segment"
+    done
+    [[ -z "$pattern" ]] && pattern="/"
+
+    matches=0
+    macro=""
+    registered=""
+    while IFS= read -r line || [[ -n "$line" ]]; do
+        if [[ "$line" == *REGISTER_* && "$line" =~ $register_re ]]; then
+            matches=$((matches + 1))
+            macro="${BASH_REMATCH[1]}"
+            registered="${BASH_REMATCH[2]}"
+        fi
+    done < "$src"
+    if [[ "$matches" != 1 ]]; then
+        echo "gen_route_manifest: $src must contain exactly one REGISTER_ROUTE or REGISTER_LAYOUT, with the pattern literal on the same line as the macro" >&2
+        exit 1
+    fi
+
+    expected_macro=ROUTE
+    [[ "$kind" == 0 ]] && expected_macro=LAYOUT
+    if [[ "$macro" != "$expected_macro" || "$registered" != "$pattern" ]]; then
+        echo "gen_route_manifest: $src registers REGISTER_$macro(\"$registered\"), but its file name maps to REGISTER_$expected_macro(\"$pattern\")" >&2
+        exit 1
+    fi
+
+    entries+="$pattern"$'\t'"$kind"$'\t'"$rel"$'\n'
+done
+
+# Sorting groups the dynamic segments by parent prefix; every sibling must use
+# the same parameter name or the Router could not tell them apart
+prev_prefix=""
+prev_param=""
+prev_rel=""
+while IFS=$'\t' read -r prefix param rel; do
+    [[ -z "$prefix" ]] && continue
+    if [[ "$prefix" == "$prev_prefix" && "$param" != "$prev_param" ]]; then
+        echo "gen_route_manifest: $app_dir/$prev_rel and $app_dir/$rel use different parameters ($prev_param, $param) under ${prefix%/}/" >&2
+        exit 1
+    fi
+    prev_prefix="$prefix"
+    prev_param="$param"
+    prev_rel="$rel"
+done <<< "$(printf '%s' "$params" | LC_ALL=C sort)"
+
+sorted="$(printf '%s' "$entries" | LC_ALL=C sort)"
+count=0
+prev_key=""
+prev_rel=""
+if [[ -n "$sorted" ]]; then
+    while IFS=$'\t' read -r pattern kind rel; do
+        if [[ "$pattern"$'\t'"$kind" == "$prev_key" ]]; then
+            echo "gen_route_manifest: $app_dir/$prev_rel and $app_dir/$rel both register \"$pattern\"" >&2
+            exit 1
+        fi
+        prev_key="$pattern"$'\t'"$kind"
+        prev_rel="$rel"
+        count=$((count + 1))
+    done <<< "$sorted"
+fi
+
+cat <<EOF
+// Generated by gen_route_manifest.sh from $app_dir. Do not edit.
+
+#pragma once
+
+#include "examples/route_manifest.h"
+
+namespace route_manifest {
+
+// sv literals carry their length, so building the table needs no constexpr strlen
+using namespace std::string_view_literals;
+
+// Workspace-relative app directory, also added as runfiles data by
+// obsidian_routes(). The runfiles path uses the module's apparent name so
+// Rlocation() resolves it through the repo mapping.
+inline constexpr std::string_view kAppDirectory = "$app_dir";
+inline constexpr std::string_view kAppRunfilesPath = "obsidian_examples/$app_dir";
+
+inline constexpr std::array<Entry, $count> kEntries = {{
+EOF
+
+if [[ -n "$sorted" ]]; then
+    while IFS=$'\t' read -r pattern kind rel; do
+        if [[ "$kind" == 0 ]]; then
+            kind_name="EntryKind::Layout"
+        else
+            kind_name="EntryKind::Route"
+        fi
+        echo "    {\"$pattern\"sv, $kind_name, \"$rel\"sv},"
+    done <<< "$sorted"
+fi
+
+echo "}};"
+
+# Checked in chunks so large apps stay within constexpr step limits
+chunk=128
+first=0
+while (( first == 0 || first < count )); do
+    last=$((first + chunk))
+    echo
+    echo "static_assert(isSorted(kEntries, $first, $last), \"route manifest must be sorted by pattern\");"
+    echo "static_assert(allPatternsValid(kEntries, $first, $last), \"malformed REGISTER_ROUTE / REGISTER_LAYOUT pattern under $app_dir\");"
+    first=$last
+done
+
+cat <<EOF
+
+} // namespace route_manifest
+EOF
@@ -0,0 +1,105 @@
+/**
+ * Route manifest types
+ *
+ * Shared by the headers that obsidian_routes() (see routes.bzl) generates
+ * from each example's app/ directory. Each entry holds the pattern passed to
+ * REGISTER_ROUTE / REGISTER_LAYOUT in its source file; the generator checks
+ * it against the file name and sorts the table at build time.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace route_manifest {
+
+// Layouts sort before routes that share the same pattern
+enum class EntryKind {
+    Layout,
+    Route,
+};
+
+struct Entry {
+    std::string_view pattern;  // e.g. "/blog/:slug"
+    EntryKind kind;
+    std::string_view source;   // path relative to the app directory
+};
+
+constexpr bool entryLess(const Entry& a, const Entry& b) {
+    if (a.pattern != b.pattern) {
+        return a.pattern < b.pattern;
+    }
+    return a.kind < b.kind;
+}
+
+// Compares each entry in [first, last) with its predecessor. The index range
+// lets generated manifests split the check into several static_asserts, each
+// within the compiler's constexpr step limit.
+template <std::size_t N>
+constexpr bool isSorted(const std::array<Entry, N>& entries,
+                        std::size_t first = 0, std::size_t last = N) {
+    for (std::size_t i = first > 0 ? first : 1; i < last && i < N; ++i) {
+        if (!entryLess(entries[i - 1], entries[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool isIdentifierChar(char c, bool first) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+           (!first && c >= '0' && c <= '9');
+}
+
+// A pattern is "/" or a sequence of "/segment" where each segment is either
+// static text or ":name" with name a C identifier, so it can map onto a
+// typed parameter. Used to reject malformed registered patterns at build time.
+constexpr bool isValidPattern(std::string_view pattern) {
+    if (pattern == "/") {
+        return true;
+    }
+    if (pattern.empty() || pattern.front() != '/' || pattern.back() == '/') {
+        return false;
+    }
+    std::size_t pos = 1;
+    while (pos <= pattern.size()) {
+        std::size_t end = pattern.find('/', pos);
+        if (end == std::string_view::npos) {
+            end = pattern.size();
+        }
+        std::string_view segment = pattern.substr(pos, end - pos);
+        if (segment.empty()) {
+            return false;
+        }
+        if (segment.front() == ':') {
+            if (segment.size() < 2) {
+                return false;
+            }
+            for (std::size_t i = 1; i < segment.size(); ++i) {
+                if (!isIdentifierChar(segment[i], i == 1)) {
+                    return false;
+                }
+            }
+        } else if (segment.find_first_of(":[]*?") != std::string_view::npos) {
+            return false;
+        }
+        pos = end + 1;
+    }
+    return true;
+}
+
+// Takes the same index range as isSorted()
+template <std::size_t N>
+constexpr bool allPatternsValid(const std::array<Entry, N>& entries,
+                                std::size_t first = 0, std::size_t last = N) {
+    for (std::size_t i = first; i < last && i < N; ++i) {
+        if (!isValidPattern(entries[i].pattern)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace route_manifest
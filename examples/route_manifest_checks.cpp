@@ -0,0 +1,49 @@
+/**
+ * Compile-time checks for route_manifest.h
+ *
+ * Nothing here runs; the target only has to build.
+ */
+
+#include "examples/route_manifest.h"
+#include "examples/route_manifest_fixture.h"
+
+using route_manifest::Entry;
+using route_manifest::EntryKind;
+using route_manifest::isValidPattern;
+
+// Accepted patterns
+static_assert(isValidPattern("/"));
+static_assert(isValidPattern("/about"));
+static_assert(isValidPattern("/products/:id"));
+static_assert(isValidPattern("/users/:userId"));
+static_assert(isValidPattern("/blog/:slug/comments"));
+static_assert(isValidPattern("/:_private1"));
+
+// Rejected patterns
+static_assert(!isValidPattern(""));
+static_assert(!isValidPattern("about"));
+static_assert(!isValidPattern("/about/"));
+static_assert(!isValidPattern("//about"));
+static_assert(!isValidPattern("/products/:"));       // [].cpp
+static_assert(!isValidPattern("/users/:1x"));        // leading digit
+static_assert(!isValidPattern("/users/:user-id"));
+static_assert(!isValidPattern("/products/[id]"));
+static_assert(!isValidPattern("/docs/:rest*"));      // catch-all is not supported
+static_assert(!isValidPattern("/files/:path?"));     // optional is not supported
+static_assert(!isValidPattern("/docs/rest*"));
+
+// Generator output for testdata/route_manifest/app
+constexpr bool entryIs(std::size_t index, std::string_view pattern, EntryKind kind,
+                       std::string_view source) {
+    const Entry& entry = route_manifest::kEntries[index];
+    return entry.pattern == pattern && entry.kind == kind && entry.source == source;
+}
+
+static_assert(route_manifest::kEntries.size() == 7);
+static_assert(entryIs(0, "/", EntryKind::Layout, "_layout.cpp"));
+static_assert(entryIs(1, "/", EntryKind::Route, "index.cpp"));
+static_assert(entryIs(2, "/docs", EntryKind::Route, "docs/index.cpp"));
+static_assert(entryIs(3, "/docs/:slug", EntryKind::Route, "docs/[slug].cpp"));
+static_assert(entryIs(4, "/guides/:section", EntryKind::Layout, "guides/[section]/_layout.cpp"));
+static_assert(entryIs(5, "/guides/:section/:page", EntryKind::Route, "guides/[section]/[page].cpp"));
+static_assert(entryIs(6, "/guides/:section/intro", EntryKind::Route, "guides/[section]/intro.cpp"));
@@ -17,10 +17,8 @@ void renderBlogPostRoute(RouteContext& ctx) {
     const auto& params = ctx.getParams();
     
     // Extract slug from params
-    std::string slug = "unknown";
-    if (params.find("slug") != params.end()) {
-        slug = params.at("slug");
-    }
+    auto slugIt = params.find("slug");
+    std::string slug = slugIt != params.end() ? slugIt->second : "unknown";
     
     TextView title;
     std::string titleText = "Blog Post: " + slug;
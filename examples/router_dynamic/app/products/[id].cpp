@@ -19,10 +19,8 @@ void renderProductRoute(RouteContext& ctx) {
     const auto& query = ctx.getQuery();
     
     // Extract product ID from params
-    std::string productId = "Unknown";
-    if (params.find("id") != params.end()) {
-        productId = params.at("id");
-    }
+    auto idIt = params.find("id");
+    std::string productId = idIt != params.end() ? idIt->second : "Unknown";
     
     TextView title;
     std::string titleText = "Product #" + productId;
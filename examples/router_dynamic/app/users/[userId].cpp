@@ -18,10 +18,8 @@ void renderUserRoute(RouteContext& ctx) {
     const auto& params = ctx.getParams();
     
     // Extract user ID from params
-    std::string userId = "Unknown";
-    if (params.find("userId") != params.end()) {
-        userId = params.at("userId");
-    }
+    auto userIdIt = params.find("userId");
+    std::string userId = userIdIt != params.end() ? userIdIt->second : "Unknown";
     
     TextView title;
     std::string titleText = "User Profile: " + userId;
@@ -10,30 +10,46 @@
  */
 
 #include <iostream>
+#include <memory>
 #include <obsidian/obsidian.h>
 #include <filesystem>
 
+#include "examples/router_patterns/routes_manifest.h"
+#include "rules_cc/cc/runfiles/runfiles.h"
+
 using namespace obsidian;
+using rules_cc::cc::runfiles::Runfiles;
 
 // Helper to find app directory - works when run via bazel or directly
-std::string findAppDirectory(const std::string& appDirName) {
-    // First, try relative to current working directory (works if run from example dir)
+// bazel-built binaries find it in runfiles (the routes library adds it as
+// data); other launches fall back to the working directory and workspace root
+std::string findAppDirectory(const char* argv0, const std::string& appDirName) {
+    std::error_code ec;
+    std::string error;
+    std::unique_ptr<Runfiles> runfiles(Runfiles::Create(argv0, BAZEL_CURRENT_REPOSITORY, &error));
+    if (runfiles) {
+        std::string appPath = runfiles->Rlocation(std::string(route_manifest::kAppRunfilesPath));
+        if (!appPath.empty() && std::filesystem::is_directory(appPath, ec)) {
+            return appPath;
+        }
+    }
+    
+    // Try relative to current working directory (works if run from example dir)
     std::filesystem::path currentDir = std::filesystem::current_path();
     std::filesystem::path testPath = currentDir / appDirName;
-    if (std::filesystem::exists(testPath) && std::filesystem::is_directory(testPath)) {
+    if (std::filesystem::is_directory(testPath, ec)) {
         return testPath.string();
     }
     
-    // Try from workspace root (where bazel runs from)
+    // Try from workspace root, e.g. the .app bundle, which has no runfiles tree
     std::filesystem::path searchPath = currentDir;
     for (int i = 0; i < 10 && !searchPath.empty() && searchPath.has_parent_path(); ++i) {
         // Check if this looks like workspace root
-        if (std::filesystem::exists(searchPath / "MODULE.bazel") ||
-            (std::filesystem::exists(searchPath / "BUILD") && 
-             std::filesystem::exists(searchPath / "examples"))) {
-            // Try examples/router_patterns/app
-            std::filesystem::path appPath = searchPath / "examples" / "router_patterns" / appDirName;
-            if (std::filesystem::exists(appPath) && std::filesystem::is_directory(appPath)) {
+        if (std::filesystem::exists(searchPath / "MODULE.bazel", ec) ||
+            (std::filesystem::exists(searchPath / "BUILD", ec) && 
+             std::filesystem::exists(searchPath / "examples", ec))) {
+            std::filesystem::path appPath = searchPath / route_manifest::kAppDirectory;
+            if (std::filesystem::is_directory(appPath, ec)) {
                 return appPath.string();
             }
             break;
@@ -45,7 +61,7 @@ std::string findAppDirectory(const std::string& appDirName) {
     return appDirName;
 }
 
-int main(int /* argc */, char* /* argv */[]) {
+int main(int /* argc */, char* argv[]) {
     std::cout << "=== Obsidian Router Patterns Example ===\n\n";
     
     // Create and initialize the application
@@ -70,7 +86,7 @@ int main(int /* argc */, char* /* argv */[]) {
     std::cout << "Window created successfully\n";
     
     // Find app directory
-    std::string appDir = findAppDirectory("app");
+    std::string appDir = findAppDirectory(argv[0], "app");
     std::cout << "Using app directory: " << appDir << std::endl;
     
     // Initialize router with app directory
@@ -0,0 +1,52 @@
+"""Macro for file-based route libraries used by the router examples."""
+
+load("@rules_cc//cc:defs.bzl", "cc_library")
+
+def obsidian_routes(name, app_dir = "app", deps = [], **kwargs):
+    """Builds the route sources under app_dir plus a generated route manifest.
+
+    Produces a cc_library named `name` that links every app/**/*.cpp file
+    (alwayslink, so REGISTER_ROUTE / REGISTER_LAYOUT static initializers are
+    kept) and exports `<name>_manifest.h`, a constexpr table of the patterns
+    the sources register, sorted at build time. The library also compiles the
+    manifest, so a malformed registered pattern fails the routes build itself.
+    The app directory is added as data so binaries can find it in runfiles.
+
+    Args:
+        name: Name of the cc_library, usually "routes".
+        app_dir: Directory holding the route files, relative to the package.
+        deps: Extra dependencies for the route sources.
+        **kwargs: Passed through to cc_library.
+    """
+    srcs = native.glob([app_dir + "/**/*.cpp"])
+    manifest = name + "_manifest.h"
+    manifest_check = name + "_manifest_check.cpp"
+    app_path = native.package_name() + "/" + app_dir
+
+    native.genrule(
+        name = name + "_manifest",
+        srcs = srcs,
+        outs = [manifest],
+        cmd = "set -f; $(location //examples:gen_route_manifest.sh) %s $(SRCS) > $@" % app_path,
+        tools = ["//examples:gen_route_manifest.sh"],
+    )
+
+    native.genrule(
+        name = name + "_manifest_check",
+        outs = [manifest_check],
+        cmd = "echo '#include \"%s/%s\"' > $@" % (native.package_name(), manifest),
+    )
+
+    cc_library(
+        name = name,
+        srcs = srcs + [manifest_check],
+        hdrs = [manifest],
+        data = native.glob([app_dir + "/**"]),
+        copts = ["-std=c++20"],
+        deps = [
+            "//examples:route_manifest",
+            "@obsidian//:obsidian",
+        ] + deps,
+        alwayslink = 1,
+        **kwargs
+    )
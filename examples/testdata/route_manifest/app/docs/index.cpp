@@ -0,0 +1,3 @@
+// Fixture for //examples:route_manifest_fixture (not compiled)
+
+REGISTER_ROUTE("/docs", renderDocsRoute);